@@ -7,8 +7,12 @@
 #include <sstream>
 #include <algorithm>
 #include <map>
+#include <cstdlib>
+#include <cerrno>
+#include <climits>
 #include <ctime>
 #include <mach/mach.h>
+#include <mach/mach_traps.h>
 #include <mach/mach_host.h>
 #include <mach/processor_info.h>
 #include <sys/sysctl.h>
@@ -99,10 +103,172 @@ private:
         uint64_t memory;
     };
     
+    struct ThreadInfo {
+        uint64_t key;
+        uint64_t tid;
+        uint64_t cpu_time;
+        std::string name;
+        char state;
+        int priority;
+        double cpu_percent;
+    };
+    
+    struct ThreadView {
+        pid_t pid;
+        std::string name;
+        bool exited;
+        double csw_rate;
+        double sample_ms;
+        std::vector<ThreadInfo> threads;
+    };
+    
     std::vector<CPUInfo> prev_cpu_info;
     std::map<std::string, NetworkInfo> prev_net_info;
     time_t prev_net_time;
     
+    // Per-thread state is only held while a thread view is open. The
+    // vectors keep their capacity between refreshes, and the (key, cpu time)
+    // samples are kept sorted by key so the previous refresh can be searched
+    // without a per-thread allocation.
+    ThreadView thread_view{};
+    task_t thread_task = MACH_PORT_NULL;
+    uint64_t thread_start_sec = 0;
+    uint64_t thread_start_usec = 0;
+    std::vector<uint64_t> thread_keys;
+    std::vector<std::pair<uint64_t, uint64_t>> prev_thread_times;
+    std::vector<std::pair<uint64_t, uint64_t>> current_thread_times;
+    std::chrono::steady_clock::time_point prev_thread_sample;
+    bool have_thread_baseline = false;
+    uint32_t prev_thread_csw = 0;
+    
+    static char threadStateChar(int run_state) {
+        switch (run_state) {
+            case TH_STATE_RUNNING: return 'R';
+            case TH_STATE_STOPPED: return 'T';
+            case TH_STATE_WAITING: return 'S';
+            case TH_STATE_UNINTERRUPTIBLE: return 'D';
+            case TH_STATE_HALTED: return 'H';
+            default: return '?';
+        }
+    }
+    
+    void releaseThreadTask() {
+        if (thread_task != MACH_PORT_NULL) {
+            mach_port_deallocate(mach_task_self(), thread_task);
+            thread_task = MACH_PORT_NULL;
+        }
+    }
+    
+    void markThreadViewExited() {
+        // Drop the baselines so a reused PID is never compared against them.
+        releaseThreadTask();
+        thread_view.exited = true;
+        thread_view.threads.clear();
+        thread_view.csw_rate = 0.0;
+        prev_thread_times.clear();
+        have_thread_baseline = false;
+        prev_thread_csw = 0;
+    }
+    
+    void recordThreadSample(uint64_t key, uint64_t tid, uint64_t cpu_time, int run_state,
+                            int priority, const char* name, double elapsed_ns, size_t& filled) {
+        current_thread_times.emplace_back(key, cpu_time);
+        
+        double cpu_percent = 0.0;
+        if (elapsed_ns > 0) {
+            auto prev = std::lower_bound(prev_thread_times.begin(), prev_thread_times.end(),
+                                         std::make_pair(key, uint64_t(0)));
+            if (prev != prev_thread_times.end() && prev->first == key && cpu_time >= prev->second) {
+                cpu_percent = 100.0 * static_cast<double>(cpu_time - prev->second) / elapsed_ns;
+            }
+        }
+        
+        if (filled == thread_view.threads.size()) {
+            thread_view.threads.emplace_back();
+        }
+        ThreadInfo& thread = thread_view.threads[filled++];
+        thread.key = key;
+        thread.tid = tid;
+        thread.cpu_time = cpu_time;
+        thread.name = name[0] ? name : "-";
+        thread.state = threadStateChar(run_state);
+        thread.priority = priority;
+        thread.cpu_percent = cpu_percent;
+    }
+    
+    bool sampleTaskThreads(double elapsed_ns, size_t& filled) {
+        thread_act_array_t threads;
+        mach_msg_type_number_t thread_count;
+        if (task_threads(thread_task, &threads, &thread_count) != KERN_SUCCESS) {
+            releaseThreadTask();
+            return false;
+        }
+        
+        for (mach_msg_type_number_t i = 0; i < thread_count; ++i) {
+            thread_identifier_info_data_t id_info;
+            mach_msg_type_number_t id_count = THREAD_IDENTIFIER_INFO_COUNT;
+            thread_extended_info_data_t info;
+            mach_msg_type_number_t info_count = THREAD_EXTENDED_INFO_COUNT;
+            
+            if (thread_info(threads[i], THREAD_IDENTIFIER_INFO, (thread_info_t)&id_info, &id_count) == KERN_SUCCESS &&
+                thread_info(threads[i], THREAD_EXTENDED_INFO, (thread_info_t)&info, &info_count) == KERN_SUCCESS) {
+                recordThreadSample(id_info.thread_id, id_info.thread_id,
+                                   info.pth_user_time + info.pth_system_time,
+                                   info.pth_run_state, info.pth_curpri, info.pth_name,
+                                   elapsed_ns, filled);
+            }
+            mach_port_deallocate(mach_task_self(), threads[i]);
+        }
+        
+        vm_deallocate(mach_task_self(), (vm_address_t)threads, thread_count * sizeof(thread_act_t));
+        return true;
+    }
+    
+    void sampleProcThreads(const struct proc_taskinfo& task_info, double elapsed_ns, size_t& filled) {
+        // Leave headroom for threads spawned between the two calls, and grow
+        // once if the list still fills the buffer.
+        size_t capacity = static_cast<size_t>(task_info.pti_threadnum) + 64;
+        if (thread_keys.size() < capacity) {
+            thread_keys.resize(capacity);
+        }
+        
+        int bytes = 0;
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            int buffer_bytes = static_cast<int>(thread_keys.size() * sizeof(uint64_t));
+#ifdef PROC_PIDLISTTHREADIDS
+            bytes = proc_pidinfo(thread_view.pid, PROC_PIDLISTTHREADIDS, 0, thread_keys.data(), buffer_bytes);
+#else
+            bytes = proc_pidinfo(thread_view.pid, PROC_PIDLISTTHREADS, 0, thread_keys.data(), buffer_bytes);
+#endif
+            if (bytes < buffer_bytes) break;
+            thread_keys.resize(thread_keys.size() * 2);
+        }
+        size_t thread_count = bytes > 0 ? bytes / sizeof(uint64_t) : 0;
+        
+        for (size_t i = 0; i < thread_count; ++i) {
+            uint64_t key = thread_keys[i];
+            struct proc_threadinfo info;
+#ifdef PROC_PIDLISTTHREADIDS
+            // Keys are the system-wide 64-bit thread IDs shown by sample,
+            // spindump and Activity Monitor.
+            if (proc_pidinfo(thread_view.pid, PROC_PIDTHREADID64INFO, key, &info, sizeof(info)) <= 0) {
+                continue;
+            }
+            uint64_t tid = key;
+#else
+            // Older SDKs only list opaque thread handles, which can't be
+            // mapped to thread IDs without the task port.
+            if (proc_pidinfo(thread_view.pid, PROC_PIDTHREADINFO, key, &info, sizeof(info)) <= 0) {
+                continue;
+            }
+            uint64_t tid = 0;
+#endif
+            recordThreadSample(key, tid, info.pth_user_time + info.pth_system_time,
+                               info.pth_run_state, info.pth_curpri, info.pth_name,
+                               elapsed_ns, filled);
+        }
+    }
+    
     double calculateCPULoad(const CPUInfo& prev, const CPUInfo& current) {
         uint64_t prev_total = prev.user + prev.system + prev.idle + prev.nice;
         uint64_t current_total = current.user + current.system + current.idle + current.nice;
@@ -415,6 +581,117 @@ public:
         return processes;
     }
     
+    bool openThreadView(pid_t pid, std::string* error = nullptr) {
+        closeThreadView();
+        
+        char name[PROC_PIDPATHINFO_MAXSIZE];
+        struct proc_bsdinfo bsd_info;
+        if (pid <= 0 || proc_name(pid, name, sizeof(name)) <= 0 ||
+            proc_pidinfo(pid, PROC_PIDTBSDINFO, 0, &bsd_info, sizeof(bsd_info)) <= 0) {
+            if (error) *error = "No such process: " + std::to_string(pid);
+            return false;
+        }
+        
+        // proc_name works for any process, but the task and thread flavors
+        // are refused for other users' processes unless we run as root.
+        struct proc_taskinfo task_info;
+        if (proc_pidinfo(pid, PROC_PIDTASKINFO, 0, &task_info, sizeof(task_info)) <= 0) {
+            if (error) {
+                if (errno == EPERM) {
+                    *error = "Permission denied for PID " + std::to_string(pid) +
+                             " (" + name + "); run as root to inspect its threads";
+                } else {
+                    *error = "No such process: " + std::to_string(pid);
+                }
+            }
+            return false;
+        }
+        
+        // With a task port every thread is read directly; without one (not
+        // root, or a protected target) fall back to libproc, which the kernel
+        // answers with a linear thread search per call.
+        if (task_for_pid(mach_task_self(), pid, &thread_task) != KERN_SUCCESS) {
+            thread_task = MACH_PORT_NULL;
+        }
+        
+        thread_view.pid = pid;
+        thread_view.name = name;
+        thread_start_sec = bsd_info.pbi_start_tvsec;
+        thread_start_usec = bsd_info.pbi_start_tvusec;
+        prev_thread_sample = std::chrono::steady_clock::now();
+        return true;
+    }
+    
+    void closeThreadView() {
+        releaseThreadTask();
+        thread_view = ThreadView{};
+        thread_start_sec = 0;
+        thread_start_usec = 0;
+        std::vector<uint64_t>().swap(thread_keys);
+        std::vector<std::pair<uint64_t, uint64_t>>().swap(prev_thread_times);
+        std::vector<std::pair<uint64_t, uint64_t>>().swap(current_thread_times);
+        have_thread_baseline = false;
+        prev_thread_csw = 0;
+    }
+    
+    const ThreadView& getProcessThreads(size_t count) {
+        ThreadView& view = thread_view;
+        if (view.pid <= 0 || view.exited) {
+            return view;
+        }
+        
+        auto sample_start = std::chrono::steady_clock::now();
+        
+        // A changed start time means the PID now belongs to another process.
+        struct proc_bsdinfo bsd_info;
+        struct proc_taskinfo task_info;
+        if (proc_pidinfo(view.pid, PROC_PIDTBSDINFO, 0, &bsd_info, sizeof(bsd_info)) <= 0 ||
+            bsd_info.pbi_start_tvsec != thread_start_sec ||
+            bsd_info.pbi_start_tvusec != thread_start_usec ||
+            proc_pidinfo(view.pid, PROC_PIDTASKINFO, 0, &task_info, sizeof(task_info)) <= 0) {
+            markThreadViewExited();
+            return view;
+        }
+        
+        auto now = std::chrono::steady_clock::now();
+        double elapsed_ns = std::chrono::duration<double, std::nano>(now - prev_thread_sample).count();
+        double elapsed_sec = elapsed_ns / NSEC_PER_SEC;
+        bool have_prev = have_thread_baseline && elapsed_ns > 0;
+        
+        current_thread_times.clear();
+        size_t filled = 0;
+        if (thread_task == MACH_PORT_NULL || !sampleTaskThreads(have_prev ? elapsed_ns : 0.0, filled)) {
+            sampleProcThreads(task_info, have_prev ? elapsed_ns : 0.0, filled);
+        }
+        view.threads.resize(filled);
+        
+        // pti_csw is a 32-bit counter; unsigned subtraction survives one wrap.
+        uint32_t csw = static_cast<uint32_t>(task_info.pti_csw);
+        view.csw_rate = (have_prev && elapsed_sec > 0)
+                        ? static_cast<double>(static_cast<uint32_t>(csw - prev_thread_csw)) / elapsed_sec
+                        : 0.0;
+        
+        std::sort(current_thread_times.begin(), current_thread_times.end());
+        prev_thread_times.swap(current_thread_times);
+        prev_thread_sample = now;
+        prev_thread_csw = csw;
+        have_thread_baseline = true;
+        
+        // Only the top rows are displayed, so don't order the rest. Ties are
+        // broken by total CPU time and then thread so idle rows stay put.
+        size_t top = std::min(count, view.threads.size());
+        std::partial_sort(view.threads.begin(), view.threads.begin() + top, view.threads.end(),
+                         [](const ThreadInfo& a, const ThreadInfo& b) {
+                             if (a.cpu_percent != b.cpu_percent) return a.cpu_percent > b.cpu_percent;
+                             if (a.cpu_time != b.cpu_time) return a.cpu_time > b.cpu_time;
+                             return a.key < b.key;
+                         });
+        
+        view.sample_ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - sample_start).count();
+        return view;
+    }
+    
     std::map<std::string, std::string> getBatteryInfo() {
         std::map<std::string, std::string> battery_info;
         
@@ -533,137 +810,243 @@ public:
     }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
     SystemMonitor monitor;
     
-    while (true) {
-        std::system("clear");
-        
-        auto sys_info = monitor.getSystemInfo();
-        std::cout << TermColors::Bold + TermColors::Blue + "System Information:" + TermColors::Reset << std::endl;
-        for (const auto& [key, value] : sys_info) {
-            std::cout << "  " << key << ": " << value << std::endl;
+    pid_t thread_pid = 0;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "-t" && i + 1 < argc) {
+            const char* value = argv[++i];
+            char* end = nullptr;
+            errno = 0;
+            long pid = std::strtol(value, &end, 10);
+            if (errno != 0 || end == value || *end != '\0' || pid <= 0 || pid > INT_MAX) {
+                std::cerr << "Invalid PID: " << value << std::endl;
+                std::cerr << "Usage: " << argv[0] << " [-t <pid>]" << std::endl;
+                return 1;
+            }
+            thread_pid = static_cast<pid_t>(pid);
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [-t <pid>]" << std::endl;
+            return 1;
         }
-        std::cout << std::endl;
-        
-        double total_cpu = monitor.getTotalCPUUsage();
-        std::cout << TermColors::Bold + TermColors::Blue + "CPU Usage:" + TermColors::Reset << std::endl;
-        std::cout << "  Total: " << TermColors::getLoadBar(total_cpu) << std::endl;
-        
-        std::vector<double> cpu_usage = monitor.getCPUUsage();
-        for (size_t i = 0; i < cpu_usage.size(); ++i) {
-            std::cout << "  Core " << i << ": " << TermColors::getLoadBar(cpu_usage[i]) << std::endl;
+    }
+    
+    const size_t thread_rows = 15;
+    bool thread_view_open = false;
+    if (thread_pid > 0) {
+        std::string error;
+        if (!monitor.openThreadView(thread_pid, &error)) {
+            std::cerr << error << std::endl;
+            return 1;
         }
-        std::cout << std::endl;
-        
-        auto [used_memory, total_memory] = monitor.getMemoryUsage();
-        double memory_percent = (used_memory / total_memory) * 100.0;
-        std::cout << TermColors::Bold + TermColors::Blue + "Memory Usage:" + TermColors::Reset << " "
-                  << TermColors::getLoadBar(memory_percent) << std::endl;
-        std::cout << "  " << std::fixed << std::setprecision(2) << used_memory
-                  << " GB / " << total_memory << " GB" << std::endl << std::endl;
-        
-        auto disk_sizes = monitor.getDiskSizes();
-        std::cout << TermColors::Bold + TermColors::Blue + "Disk Usage:" + TermColors::Reset << std::endl;
-        for (const auto& [mount_point, sizes] : disk_sizes) {
-            uint64_t used = sizes.first;
-            uint64_t total = sizes.second;
-            double usage_percent = 0.0;
-            if (total > 0) {
-                usage_percent = 100.0 * static_cast<double>(used) / total;
-            }
+        thread_view_open = true;
+        // Prime the per-thread counters so the first frame shows real deltas.
+        monitor.getProcessThreads(thread_rows);
+    }
+    
+    // The dashboard keeps its 2 second cadence; only the thread panel is
+    // refreshed at 1 Hz. Frames are scheduled against a fixed deadline so
+    // collection time doesn't stretch the period.
+    const auto dashboard_interval = std::chrono::seconds(2);
+    const auto frame_interval = thread_view_open ? std::chrono::seconds(1) : dashboard_interval;
+    auto next_frame = std::chrono::steady_clock::now();
+    auto next_dashboard = next_frame;
+    std::string dashboard;
+    
+    while (true) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= next_dashboard) {
+            std::stringstream out;
             
-            double used_gb = static_cast<double>(used) / (1024 * 1024 * 1024);
-            double total_gb = static_cast<double>(total) / (1024 * 1024 * 1024);
+            auto sys_info = monitor.getSystemInfo();
+            out << TermColors::Bold + TermColors::Blue + "System Information:" + TermColors::Reset << std::endl;
+            for (const auto& [key, value] : sys_info) {
+                out << "  " << key << ": " << value << std::endl;
+            }
+            out << std::endl;
             
-            std::cout << "  " << mount_point << ": " << TermColors::getLoadBar(usage_percent) << std::endl;
-            std::cout << "    " << std::fixed << std::setprecision(2) << used_gb
-                      << " GB / " << total_gb << " GB" << std::endl;
-        }
-        std::cout << std::endl;
-        
-        auto net_usage = monitor.getNetworkUsage();
-        std::cout << TermColors::Bold + TermColors::Blue + "Network Usage:" + TermColors::Reset << std::endl;
-        for (const auto& [interface, rates] : net_usage) {
-            double in_rate = rates.first;
-            double out_rate = rates.second;
+            double total_cpu = monitor.getTotalCPUUsage();
+            out << TermColors::Bold + TermColors::Blue + "CPU Usage:" + TermColors::Reset << std::endl;
+            out << "  Total: " << TermColors::getLoadBar(total_cpu) << std::endl;
             
-            std::stringstream in_ss, out_ss;
-            in_ss << std::fixed << std::setprecision(2);
-            out_ss << std::fixed << std::setprecision(2);
+            std::vector<double> cpu_usage = monitor.getCPUUsage();
+            for (size_t i = 0; i < cpu_usage.size(); ++i) {
+                out << "  Core " << i << ": " << TermColors::getLoadBar(cpu_usage[i]) << std::endl;
+            }
+            out << std::endl;
             
-            if (in_rate < 1024) in_ss << in_rate << " B/s";
-            else if (in_rate < 1024 * 1024) in_ss << (in_rate / 1024) << " KB/s";
-            else if (in_rate < 1024 * 1024 * 1024) in_ss << (in_rate / (1024 * 1024)) << " MB/s";
-            else in_ss << (in_rate / (1024 * 1024 * 1024)) << " GB/s";
+            auto [used_memory, total_memory] = monitor.getMemoryUsage();
+            double memory_percent = (used_memory / total_memory) * 100.0;
+            out << TermColors::Bold + TermColors::Blue + "Memory Usage:" + TermColors::Reset << " "
+                << TermColors::getLoadBar(memory_percent) << std::endl;
+            out << "  " << std::fixed << std::setprecision(2) << used_memory
+                << " GB / " << total_memory << " GB" << std::endl << std::endl;
             
-            if (out_rate < 1024) out_ss << out_rate << " B/s";
-            else if (out_rate < 1024 * 1024) out_ss << (out_rate / 1024) << " KB/s";
-            else if (out_rate < 1024 * 1024 * 1024) out_ss << (out_rate / (1024 * 1024)) << " MB/s";
-            else out_ss << (out_rate / (1024 * 1024 * 1024)) << " GB/s";
+            auto disk_sizes = monitor.getDiskSizes();
+            out << TermColors::Bold + TermColors::Blue + "Disk Usage:" + TermColors::Reset << std::endl;
+            for (const auto& [mount_point, sizes] : disk_sizes) {
+                uint64_t used = sizes.first;
+                uint64_t total = sizes.second;
+                double usage_percent = 0.0;
+                if (total > 0) {
+                    usage_percent = 100.0 * static_cast<double>(used) / total;
+                }
+                
+                double used_gb = static_cast<double>(used) / (1024 * 1024 * 1024);
+                double total_gb = static_cast<double>(total) / (1024 * 1024 * 1024);
+                
+                out << "  " << mount_point << ": " << TermColors::getLoadBar(usage_percent) << std::endl;
+                out << "    " << std::fixed << std::setprecision(2) << used_gb
+                    << " GB / " << total_gb << " GB" << std::endl;
+            }
+            out << std::endl;
             
-            std::cout << "  " << interface << ":" << std::endl;
-            std::cout << "    ↓ " << in_ss.str() << std::endl;
-            std::cout << "    ↑ " << out_ss.str() << std::endl;
-        }
-        std::cout << std::endl;
-        
-        auto battery_info = monitor.getBatteryInfo();
-        if (!battery_info.empty()) {
-            std::cout << TermColors::Bold + TermColors::Blue + "Battery:" + TermColors::Reset << std::endl;
-            double battery_percent = -1.0;
-            if (battery_info.find("Percentage") != battery_info.end()) {
-                battery_percent = std::stod(battery_info["Percentage"]);
+            auto net_usage = monitor.getNetworkUsage();
+            out << TermColors::Bold + TermColors::Blue + "Network Usage:" + TermColors::Reset << std::endl;
+            for (const auto& [interface, rates] : net_usage) {
+                double in_rate = rates.first;
+                double out_rate = rates.second;
+                
+                std::stringstream in_ss, out_ss;
+                in_ss << std::fixed << std::setprecision(2);
+                out_ss << std::fixed << std::setprecision(2);
+                
+                if (in_rate < 1024) in_ss << in_rate << " B/s";
+                else if (in_rate < 1024 * 1024) in_ss << (in_rate / 1024) << " KB/s";
+                else if (in_rate < 1024 * 1024 * 1024) in_ss << (in_rate / (1024 * 1024)) << " MB/s";
+                else in_ss << (in_rate / (1024 * 1024 * 1024)) << " GB/s";
+                
+                if (out_rate < 1024) out_ss << out_rate << " B/s";
+                else if (out_rate < 1024 * 1024) out_ss << (out_rate / 1024) << " KB/s";
+                else if (out_rate < 1024 * 1024 * 1024) out_ss << (out_rate / (1024 * 1024)) << " MB/s";
+                else out_ss << (out_rate / (1024 * 1024 * 1024)) << " GB/s";
+                
+                out << "  " << interface << ":" << std::endl;
+                out << "    ↓ " << in_ss.str() << std::endl;
+                out << "    ↑ " << out_ss.str() << std::endl;
             }
+            out << std::endl;
             
-            if (battery_percent >= 0) {
-                std::cout << "  Level: " << TermColors::getLoadBar(battery_percent) << std::endl;
+            auto battery_info = monitor.getBatteryInfo();
+            if (!battery_info.empty()) {
+                out << TermColors::Bold + TermColors::Blue + "Battery:" + TermColors::Reset << std::endl;
+                double battery_percent = -1.0;
+                if (battery_info.find("Percentage") != battery_info.end()) {
+                    battery_percent = std::stod(battery_info["Percentage"]);
+                }
+                
+                if (battery_percent >= 0) {
+                    out << "  Level: " << TermColors::getLoadBar(battery_percent) << std::endl;
+                }
+                
+                for (const auto& [key, value] : battery_info) {
+                    if (key != "Percentage") {
+                        out << "  " << key << ": " << value << std::endl;
+                    }
+                }
+                out << std::endl;
             }
             
-            for (const auto& [key, value] : battery_info) {
-                if (key != "Percentage") {
-                    std::cout << "  " << key << ": " << value << std::endl;
+            auto processes = monitor.getTopProcesses(5);
+            out << TermColors::Bold + TermColors::Blue + "Top Processes:" + TermColors::Reset << std::endl;
+            out << "  " << std::setw(6) << "PID" << " | "
+                << std::setw(8) << "USER" << " | "
+                << std::setw(8) << "CPU%" << " | "
+                << std::setw(10) << "MEMORY" << " | "
+                << "NAME" << std::endl;
+            
+            out << "  " << std::string(50, '-') << std::endl;
+            for (const auto& proc : processes) {
+                double mem_mb = static_cast<double>(proc.memory) / (1024 * 1024);
+                std::stringstream mem_ss;
+                mem_ss << std::fixed << std::setprecision(1);
+                
+                if (mem_mb < 1024) mem_ss << mem_mb << "M";
+                else mem_ss << (mem_mb / 1024) << "G";
+                
+                out << "  " << std::setw(6) << proc.pid << " | "
+                    << std::setw(8) << proc.user << " | ";
+                
+                std::string cpu_str = std::to_string(static_cast<int>(proc.cpu_percent)) + "%";
+                if (proc.cpu_percent >= 50.0) {
+                    out << std::setw(8) << (TermColors::Red + cpu_str + TermColors::Reset) << " | ";
+                } else if (proc.cpu_percent >= 20.0) {
+                    out << std::setw(8) << (TermColors::Yellow + cpu_str + TermColors::Reset) << " | ";
+                } else {
+                    out << std::setw(8) << (TermColors::Green + cpu_str + TermColors::Reset) << " | ";
                 }
+                
+                out << std::setw(10) << mem_ss.str() << " | "
+                    << proc.name << std::endl;
+            }
+            out << std::endl;
+            dashboard = out.str();
+            
+            next_dashboard += dashboard_interval;
+            if (next_dashboard <= now) {
+                next_dashboard = now + dashboard_interval;
             }
-            std::cout << std::endl;
         }
         
-        auto processes = monitor.getTopProcesses(5);
-        std::cout << TermColors::Bold + TermColors::Blue + "Top Processes:" + TermColors::Reset << std::endl;
-        std::cout << "  " << std::setw(6) << "PID" << " | "
-                  << std::setw(8) << "USER" << " | "
-                  << std::setw(8) << "CPU%" << " | "
-                  << std::setw(10) << "MEMORY" << " | "
-                  << "NAME" << std::endl;
+        std::cout << "\033[H\033[2J" << dashboard;
         
-        std::cout << "  " << std::string(50, '-') << std::endl;
-        for (const auto& proc : processes) {
-            double mem_mb = static_cast<double>(proc.memory) / (1024 * 1024);
-            std::stringstream mem_ss;
-            mem_ss << std::fixed << std::setprecision(1);
-            
-            if (mem_mb < 1024) mem_ss << mem_mb << "M";
-            else mem_ss << (mem_mb / 1024) << "G";
-            
-            std::cout << "  " << std::setw(6) << proc.pid << " | "
-                      << std::setw(8) << proc.user << " | ";
-            
-            std::string cpu_str = std::to_string(static_cast<int>(proc.cpu_percent)) + "%";
-            if (proc.cpu_percent >= 50.0) {
-                std::cout << std::setw(8) << (TermColors::Red + cpu_str + TermColors::Reset) << " | ";
-            } else if (proc.cpu_percent >= 20.0) {
-                std::cout << std::setw(8) << (TermColors::Yellow + cpu_str + TermColors::Reset) << " | ";
+        if (thread_view_open) {
+            const auto& view = monitor.getProcessThreads(thread_rows);
+            std::cout << TermColors::Bold + TermColors::Blue + "Threads of " + view.name +
+                         " (PID " + std::to_string(view.pid) + "):" + TermColors::Reset << std::endl;
+            if (view.exited) {
+                std::cout << "  " << TermColors::Red + "Process exited" + TermColors::Reset << std::endl;
             } else {
-                std::cout << std::setw(8) << (TermColors::Green + cpu_str + TermColors::Reset) << " | ";
+                std::stringstream csw_ss, cost_ss;
+                csw_ss << std::fixed << std::setprecision(0) << view.csw_rate << "/s";
+                cost_ss << std::fixed << std::setprecision(1) << view.sample_ms << " ms";
+                std::cout << "  Threads: " << view.threads.size()
+                          << "  Context switches: " << csw_ss.str()
+                          << "  Sampled in: " << cost_ss.str() << std::endl;
+                
+                std::cout << "  " << std::setw(20) << "TID" << " | "
+                          << std::setw(5) << "STATE" << " | "
+                          << std::setw(4) << "PRI" << " | "
+                          << std::setw(8) << "CPU%" << " | "
+                          << "NAME" << std::endl;
+                
+                std::cout << "  " << std::string(60, '-') << std::endl;
+                size_t shown = std::min(view.threads.size(), thread_rows);
+                for (size_t i = 0; i < shown; ++i) {
+                    const auto& thread = view.threads[i];
+                    std::cout << "  " << std::setw(20)
+                              << (thread.tid ? std::to_string(thread.tid) : std::string("-")) << " | "
+                              << std::setw(5) << thread.state << " | "
+                              << std::setw(4) << thread.priority << " | ";
+                
+                    std::stringstream cpu_ss;
+                    cpu_ss << std::fixed << std::setprecision(1) << thread.cpu_percent << "%";
+                    std::string cpu_str = cpu_ss.str();
+                    if (thread.cpu_percent >= 50.0) {
+                        std::cout << std::setw(8) << (TermColors::Red + cpu_str + TermColors::Reset) << " | ";
+                    } else if (thread.cpu_percent >= 20.0) {
+                        std::cout << std::setw(8) << (TermColors::Yellow + cpu_str + TermColors::Reset) << " | ";
+                    } else {
+                        std::cout << std::setw(8) << (TermColors::Green + cpu_str + TermColors::Reset) << " | ";
+                    }
+                
+                    std::cout << thread.name << std::endl;
+                }
             }
-            
-            std::cout << std::setw(10) << mem_ss.str() << " | "
-                      << proc.name << std::endl;
+            std::cout << std::endl;
         }
-        std::cout << std::endl;
         
         std::cout << TermColors::Bold + "Press Ctrl+C to exit" + TermColors::Reset << std::endl;
-        std::this_thread::sleep_for(std::chrono::seconds(2));
+        
+        next_frame += frame_interval;
+        now = std::chrono::steady_clock::now();
+        if (next_frame < now) {
+            // A frame overran its slot; resync instead of bursting to catch up.
+            next_frame = now + frame_interval;
+        }
+        std::this_thread::sleep_until(next_frame);
     }
     
     return 0;